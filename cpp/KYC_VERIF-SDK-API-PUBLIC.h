@@ -12,6 +12,7 @@ KycVerifDetection-SDK public header
 #define _KYC_VERIF_SDK_API_PUBLIC_H_
 
 #include <string>
+#include <utility>
 #include <assert.h>
 
 #define KYC_VERIF_SDK_VERSION_MAJOR		0
@@ -27,6 +28,7 @@ KycVerifDetection-SDK public header
 # 			define KYC_VERIF_SDK_PUBLIC_API		__declspec(dllexport)
 #		else
 # 			define KYC_VERIF_SDK_PUBLIC_API		__declspec(dllimport)
+#			define KYC_VERIF_SDK_PUBLIC_API_DLLIMPORT	1
 #		endif
 #	else
 # 		define KYC_VERIF_SDK_PUBLIC_API			__attribute__((visibility("default")))
@@ -177,6 +179,17 @@ namespace KycVerif
 #if !defined(SWIG)
 		KycVerifSdkResult& operator=(const KycVerifSdkResult& other) { return operatorAssign(other); }
 #endif
+		// Move operations are disabled when the class is imported from the DLL: the prebuilt DLL doesn't export them.
+#if !defined(SWIG) && !defined(KYC_VERIF_SDK_PUBLIC_API_DLLIMPORT)
+		/*! Move constructor. Takes ownership of the phrase and JSON strings without copying them.
+		The moved-from result has a zero \ref code, null \ref phrase and null \ref json.
+		*/
+		KycVerifSdkResult(KycVerifSdkResult&& other) noexcept : code_(0), phrase_(nullptr), json_(nullptr), numVIZs_(0) { swap(other); }
+		/*! Move assignment. Takes ownership of the phrase and JSON strings without copying them.
+		The previous content is released when the moved-from result is destroyed.
+		*/
+		KycVerifSdkResult& operator=(KycVerifSdkResult&& other) noexcept { swap(other); return *this; }
+#endif
 
 		/*! The result code. >=0 if success, <0 otherwise.
 		*/
@@ -204,6 +217,14 @@ namespace KycVerif
 #if !defined(SWIG)
 		KycVerifSdkResult& operatorAssign(const KycVerifSdkResult& other);
 #endif /* SWIG */
+#if !defined(SWIG) && !defined(KYC_VERIF_SDK_PUBLIC_API_DLLIMPORT)
+		inline void swap(KycVerifSdkResult& other) noexcept {
+			std::swap(code_, other.code_);
+			std::swap(phrase_, other.phrase_);
+			std::swap(json_, other.json_);
+			std::swap(numVIZs_, other.numVIZs_);
+		}
+#endif /* !SWIG && !KYC_VERIF_SDK_PUBLIC_API_DLLIMPORT */
 
 	private:
 		int code_;
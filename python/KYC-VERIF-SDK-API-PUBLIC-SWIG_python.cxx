@@ -4374,7 +4374,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_init__SWIG_0(PyObject *SWIGUNUSEDPA
   }
   arg2 = reinterpret_cast< KycVerif::KycVerifSdkParallelDeliveryCallback * >(argp2);
   result = KycVerif::KycVerifSdkEngine::init((char const *)arg1,(KycVerif::KycVerifSdkParallelDeliveryCallback const *)arg2);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return resultobj;
 fail:
@@ -4399,7 +4399,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_init__SWIG_1(PyObject *SWIGUNUSEDPA
   }
   arg1 = reinterpret_cast< char * >(buf1);
   result = KycVerif::KycVerifSdkEngine::init((char const *)arg1);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
   return resultobj;
 fail:
@@ -4414,7 +4414,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_init__SWIG_2(PyObject *SWIGUNUSEDPA
   
   if (!PyArg_ParseTuple(args,(char *)":KycVerifSdkEngine_init")) SWIG_fail;
   result = KycVerif::KycVerifSdkEngine::init();
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -4472,7 +4472,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_deInit(PyObject *SWIGUNUSEDPARM(sel
   
   if (!PyArg_ParseTuple(args,(char *)":KycVerifSdkEngine_deInit")) SWIG_fail;
   result = KycVerif::KycVerifSdkEngine::deInit();
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -4546,7 +4546,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_process__SWIG_0(PyObject *SWIGUNUSE
   } 
   arg6 = static_cast< int >(val6);
   result = KycVerif::KycVerifSdkEngine::process(arg1,(void const *)arg2,arg3,arg4,arg5,arg6);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -4611,7 +4611,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_process__SWIG_1(PyObject *SWIGUNUSE
   } 
   arg5 = static_cast< size_t >(val5);
   result = KycVerif::KycVerifSdkEngine::process(arg1,(void const *)arg2,arg3,arg4,arg5);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -4667,7 +4667,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_process__SWIG_2(PyObject *SWIGUNUSE
   } 
   arg4 = static_cast< size_t >(val4);
   result = KycVerif::KycVerifSdkEngine::process(arg1,(void const *)arg2,arg3,arg4);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -4800,7 +4800,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_process__SWIG_3(PyObject *SWIGUNUSE
   } 
   arg11 = static_cast< int >(val11);
   result = KycVerif::KycVerifSdkEngine::process(arg1,(void const *)arg2,(void const *)arg3,(void const *)arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -4924,7 +4924,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_process__SWIG_4(PyObject *SWIGUNUSE
   } 
   arg10 = static_cast< size_t >(val10);
   result = KycVerif::KycVerifSdkEngine::process(arg1,(void const *)arg2,(void const *)arg3,(void const *)arg4,arg5,arg6,arg7,arg8,arg9,arg10);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -5039,7 +5039,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_process__SWIG_5(PyObject *SWIGUNUSE
   } 
   arg9 = static_cast< size_t >(val9);
   result = KycVerif::KycVerifSdkEngine::process(arg1,(void const *)arg2,(void const *)arg3,(void const *)arg4,arg5,arg6,arg7,arg8,arg9);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -5077,7 +5077,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_process__SWIG_6(PyObject *SWIGUNUSE
   } 
   arg2 = static_cast< size_t >(val2);
   result = KycVerif::KycVerifSdkEngine::process((void const *)arg1,arg2);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -5435,7 +5435,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_requestRuntimeLicenseKey__SWIG_0(Py
   temp1 = static_cast< bool >(val1);
   arg1 = &temp1;
   result = KycVerif::KycVerifSdkEngine::requestRuntimeLicenseKey((bool const &)*arg1);
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
@@ -5448,7 +5448,7 @@ SWIGINTERN PyObject *_wrap_KycVerifSdkEngine_requestRuntimeLicenseKey__SWIG_1(Py
   
   if (!PyArg_ParseTuple(args,(char *)":KycVerifSdkEngine_requestRuntimeLicenseKey")) SWIG_fail;
   result = KycVerif::KycVerifSdkEngine::requestRuntimeLicenseKey();
-  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(static_cast< const KycVerif::KycVerifSdkResult& >(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
+  resultobj = SWIG_NewPointerObj((new KycVerif::KycVerifSdkResult(std::move(result))), SWIGTYPE_p_KycVerif__KycVerifSdkResult, SWIG_POINTER_OWN |  0 );
   return resultobj;
 fail:
   return NULL;
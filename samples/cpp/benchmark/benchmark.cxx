@@ -13,8 +13,21 @@
 #include <random>
 #include <mutex>
 #include <condition_variable>
+#include <thread>
+#include <cstdio> // std::rename, std::remove
+#include <cstdlib> // std::strtol
 #if defined(_WIN32)
 #include <algorithm> // std::replace
+#if !defined(NOMINMAX)
+#	define NOMINMAX // do not define min/max macros, std::min/std::max are used
+#endif
+#include <windows.h>
+#include <psapi.h> // GetProcessMemoryInfo
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h> // getrusage
+#include <unistd.h> // sysconf
+#include <sched.h> // sched_setaffinity
 #endif
 
 using namespace KycVerif;
@@ -33,9 +46,6 @@ static const char* __jsonConfig =
 "\"debug_write_input_image_enabled\": false,"
 "\"debug_internal_data_path\": \".\","
 ""
-"\"num_threads\": -1,"
-"\"max_latency\": -1,"
-"\"max_batchsize\": -1,"
 "\"asm_enabled\": true,"
 "\"intrin_enabled\": true,"
 ""
@@ -46,7 +56,6 @@ static const char* __jsonConfig =
 "\"graph_2ndpass_ocr_threshold\": 0.9,"
 "\"graph_2ndpass_umeyama_enabled\": true,"
 ""
-"\"ocr_2passes\": true,"
 "\"ocr_2ndpass_threshold\": 0.9,"
 "\"ocr_patch_antialias\": true,"
 "\"ocr_tunning_apply_patterns\": true,"
@@ -57,17 +66,161 @@ static const char* __jsonConfig =
 "\"magsac_max_iters\": 5000,"
 "\"magsac_resampler\": \"uniform\","
 ""
-"\"tps_enabled\": true,"
 "\"tps_speed\": 1,"
 "\"tps_cost\": \"l2\","
 ""
-"\"stn_enabled\": true,"
-""
 "\"detect_threshold\": 0.3,"
 ""
 "\"text_segmentation_type\": \"watershed\""
 ;
 
+/*
+* Admission control used to bound the number of in-flight requests in parallel mode.
+* When the limit is reached the processing function is not called until a result is
+* delivered (blocking policy) or the request is rejected (reject policy).
+*/
+struct KycAdmission {
+	bool acquire() {
+		std::unique_lock<std::mutex > lk(mutex);
+		if (maxInFlight > 0 && inFlight >= maxInFlight) {
+			if (!blocking) {
+				++rejected;
+				return false;
+			}
+			condVar.wait(lk, [this] { return inFlight < maxInFlight; });
+		}
+		peakInFlight = std::max(peakInFlight, ++inFlight);
+		return true;
+	}
+
+	void release() {
+		std::lock_guard<std::mutex > lk(mutex);
+		if (inFlight > 0) {
+			--inFlight;
+		}
+		condVar.notify_one();
+	}
+
+	void snapshot(size_t& inFlight_, size_t& peakInFlight_, size_t& rejected_) {
+		std::lock_guard<std::mutex > lk(mutex);
+		inFlight_ = inFlight;
+		peakInFlight_ = peakInFlight;
+		rejected_ = rejected;
+	}
+
+	std::mutex mutex;
+	std::condition_variable condVar;
+	size_t maxInFlight = 0; // 0 means unbounded
+	bool blocking = true;
+	size_t inFlight = 0;
+	size_t peakInFlight = 0;
+	size_t rejected = 0;
+};
+static KycAdmission admission;
+
+/*
+* Runtime metrics collected around the processing function and exported using Prometheus text format.
+* The latency histogram is only exported in sequential mode: in parallel mode the results could be
+* delivered in a different order than the submissions (batching) which means a result cannot be
+* paired with its submission time.
+* Prometheus text format: https://prometheus.io/docs/instrumenting/exposition_formats/
+*/
+struct KycMetrics {
+	void submitted() {
+		std::lock_guard<std::mutex > lk(mutex);
+		++requests;
+	}
+
+	void delivered(const KycVerifSdkResult& result) {
+		std::lock_guard<std::mutex > lk(mutex);
+		if (result.isOK()) {
+			++resultsOK;
+			vizs += result.numVIZs();
+		}
+		else {
+			++resultsError;
+		}
+	}
+
+	void observeLatency(const double elapsedInSeconds) {
+		std::lock_guard<std::mutex > lk(mutex);
+		for (size_t i = 0; i < sizeof(bucketsInSeconds) / sizeof(bucketsInSeconds[0]); ++i) {
+			if (elapsedInSeconds <= bucketsInSeconds[i]) {
+				++bucketCounts[i];
+			}
+		}
+		latencySumInSeconds += elapsedInSeconds;
+		++latencyCount;
+	}
+
+	// Writes into a temporary file then renames it so that a scraper never reads a partial file.
+	bool writePrometheus(const std::string& path, const bool parallel) {
+		size_t inFlight, peakInFlight, rejected;
+		admission.snapshot(inFlight, peakInFlight, rejected);
+		const std::string tmpPath = path + ".tmp";
+		FILE* file = fopen(tmpPath.c_str(), "w");
+		if (!file) {
+			KYC_VERIF_SDK_PRINT_ERROR("Failed to open metrics file at: %s", tmpPath.c_str());
+			return false;
+		}
+		{
+			std::lock_guard<std::mutex > lk(mutex);
+			fprintf(file, "# HELP kyc_requests_total Number of images submitted to the processing function.\n");
+			fprintf(file, "# TYPE kyc_requests_total counter\n");
+			fprintf(file, "kyc_requests_total %zu\n", requests);
+			fprintf(file, "# HELP kyc_results_total Number of results delivered, by status.\n");
+			fprintf(file, "# TYPE kyc_results_total counter\n");
+			fprintf(file, "kyc_results_total{status=\"ok\"} %zu\n", resultsOK);
+			fprintf(file, "kyc_results_total{status=\"error\"} %zu\n", resultsError);
+			fprintf(file, "# HELP kyc_rejections_total Number of requests rejected because the maximum number of in-flight requests was reached.\n");
+			fprintf(file, "# TYPE kyc_rejections_total counter\n");
+			fprintf(file, "kyc_rejections_total %zu\n", rejected);
+			fprintf(file, "# HELP kyc_vizs_total Number of Visual Inspection Zones (VIZ) found.\n");
+			fprintf(file, "# TYPE kyc_vizs_total counter\n");
+			fprintf(file, "kyc_vizs_total %zu\n", vizs);
+			fprintf(file, "# HELP kyc_pending_requests Number of requests submitted but not delivered yet.\n");
+			fprintf(file, "# TYPE kyc_pending_requests gauge\n");
+			fprintf(file, "kyc_pending_requests %zu\n", inFlight);
+			fprintf(file, "# HELP kyc_pending_requests_peak Highest number of in-flight requests.\n");
+			fprintf(file, "# TYPE kyc_pending_requests_peak gauge\n");
+			fprintf(file, "kyc_pending_requests_peak %zu\n", peakInFlight);
+			fprintf(file, "# HELP kyc_parallel_mode Whether the parallel mode is enabled.\n");
+			fprintf(file, "# TYPE kyc_parallel_mode gauge\n");
+			fprintf(file, "kyc_parallel_mode %d\n", parallel ? 1 : 0);
+			if (!parallel) {
+				fprintf(file, "# HELP kyc_latency_seconds Time spent in the processing function (sequential mode only).\n");
+				fprintf(file, "# TYPE kyc_latency_seconds histogram\n");
+				for (size_t i = 0; i < sizeof(bucketsInSeconds) / sizeof(bucketsInSeconds[0]); ++i) {
+					fprintf(file, "kyc_latency_seconds_bucket{le=\"%g\"} %zu\n", bucketsInSeconds[i], bucketCounts[i]);
+				}
+				fprintf(file, "kyc_latency_seconds_bucket{le=\"+Inf\"} %zu\n", latencyCount);
+				fprintf(file, "kyc_latency_seconds_sum %lf\n", latencySumInSeconds);
+				fprintf(file, "kyc_latency_seconds_count %zu\n", latencyCount);
+			}
+		}
+		fclose(file);
+#if defined(_WIN32)
+		std::remove(path.c_str()); // rename() doesn't overwrite on Windows
+#endif
+		if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+			KYC_VERIF_SDK_PRINT_ERROR("Failed to rename %s to %s", tmpPath.c_str(), path.c_str());
+			return false;
+		}
+		return true;
+	}
+
+	std::mutex mutex;
+	size_t requests = 0;
+	size_t resultsOK = 0;
+	size_t resultsError = 0;
+	size_t vizs = 0;
+	const double bucketsInSeconds[10] = { 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0 };
+	size_t bucketCounts[10] = { 0 };
+	double latencySumInSeconds = 0.0;
+	size_t latencyCount = 0;
+};
+static KycMetrics metrics;
+
 /*
 * Parallel callback function used for notification. Not mandatory.
 * More info about parallel delivery: https://www.doubango.org/SDKs/kyc-documents-verif/docs/Parallel_versus_sequential_processing.html
@@ -80,13 +233,15 @@ public:
 	virtual void onNewResult(const KycVerifSdkResult* result) const override {
 		// Use m_pMyDummyData here if you want
 		KYC_VERIF_SDK_ASSERT(result != nullptr);
-		const std::string& json = result->json();
+		metrics.delivered(*result);
+		admission.release();
+		const char* json = result->json(); // no copy, only valid during the callback
 		// Printing to the console could be very slow and delayed -> stop displaying the result as soon as all faces are processed
 		KYC_VERIF_SDK_PRINT_INFO("MyKycVerifSdkParallelDeliveryCallback::onNewResult(%d, %s, %zu): %s",
 			result->code(),
 			result->phrase(),
 			++parallelNotifCount,
-			!json.empty() ? json.c_str() : "{}"
+			(json && *json) ? json : "{}"
 		);
 		parallelNotifCondVar.notify_one();
 	}
@@ -95,6 +250,9 @@ private:
 };
 
 static void printUsage(const std::string& message = "");
+static bool memoryUsage(size_t& currentInBytes, size_t& peakInBytes);
+static void printMemoryUsage(const char* step);
+static bool setCpuAffinity(const std::string& cpuSet);
 
 int main(int argc, char *argv[])
 {
@@ -105,8 +263,14 @@ int main(int argc, char *argv[])
 	std::string vinoActivation = "auto";
 	bool isParallelDeliveryEnabled = true;
 	bool isGpuCtrlMemoryEnabled = true;
+	bool isTpsEnabled = true;
+	bool isStnEnabled = true;
+	bool isOcr2PassesEnabled = true;
 	size_t loopCount = 20;
-	std::string imagePath;
+	int numThreads = -1, maxLatency = -1, maxBatchSize = -1;
+	std::string imagePath, metricsFile, cpuSet;
+	size_t metricsIntervalInMillis = 1000;
+	size_t bestFrameWindow = 1;
 
 	// Parsing args
 	std::map<std::string, std::string > args;
@@ -138,6 +302,51 @@ int main(int argc, char *argv[])
 	if (args.find("--gpu_ctrl_mem") != args.end()) {
 		isGpuCtrlMemoryEnabled = (args["--gpu_ctrl_mem"].compare("true") == 0);
 	}
+	if (args.find("--num_threads") != args.end()) {
+		numThreads = std::atoi(args["--num_threads"].c_str());
+	}
+	if (args.find("--max_latency") != args.end()) {
+		maxLatency = std::atoi(args["--max_latency"].c_str());
+	}
+	if (args.find("--max_batchsize") != args.end()) {
+		maxBatchSize = std::atoi(args["--max_batchsize"].c_str());
+	}
+	if (args.find("--best_frame_window") != args.end()) {
+		const int window = std::atoi(args["--best_frame_window"].c_str());
+		if (window < 1 || static_cast<size_t>(window) > loopCount) {
+			printUsage("--best_frame_window must be within [1, --loops]");
+			return -1;
+		}
+		bestFrameWindow = static_cast<size_t>(window);
+	}
+	if (args.find("--cpu_set") != args.end()) {
+		cpuSet = args["--cpu_set"];
+	}
+	if (args.find("--max_inflight") != args.end()) {
+		const int maxInFlight = std::atoi(args["--max_inflight"].c_str());
+		if (maxInFlight < 0) {
+			printUsage("--max_inflight must be within [0, inf]");
+			return -1;
+		}
+		admission.maxInFlight = static_cast<size_t>(maxInFlight);
+	}
+	if (args.find("--inflight_policy") != args.end()) {
+		const std::string& policy = args["--inflight_policy"];
+		if (policy.compare("block") != 0 && policy.compare("reject") != 0) {
+			printUsage("--inflight_policy must be \"block\" or \"reject\"");
+			return -1;
+		}
+		admission.blocking = (policy.compare("block") == 0);
+	}
+	if (args.find("--tps") != args.end()) {
+		isTpsEnabled = (args["--tps"].compare("true") == 0);
+	}
+	if (args.find("--stn") != args.end()) {
+		isStnEnabled = (args["--stn"].compare("true") == 0);
+	}
+	if (args.find("--ocr_2passes") != args.end()) {
+		isOcr2PassesEnabled = (args["--ocr_2passes"].compare("true") == 0);
+	}
 	if (args.find("--assets") != args.end()) {
 		assetsFolder = args["--assets"];
 #if defined(_WIN32)
@@ -148,6 +357,20 @@ int main(int argc, char *argv[])
 		vinoActivation = args["--vino_activation"];
 	}
 	
+	if (args.find("--metrics_file") != args.end()) {
+		metricsFile = args["--metrics_file"];
+#if defined(_WIN32)
+		std::replace(metricsFile.begin(), metricsFile.end(), '\\', '/');
+#endif
+	}
+	if (args.find("--metrics_interval") != args.end()) {
+		const int interval = std::atoi(args["--metrics_interval"].c_str());
+		if (interval < 1) {
+			printUsage("--metrics_interval must be within [1, inf]");
+			return -1;
+		}
+		metricsIntervalInMillis = static_cast<size_t>(interval);
+	}
 	if (args.find("--tokenfile") != args.end()) {
 		licenseTokenFile = args["--tokenfile"];
 #if defined(_WIN32)
@@ -174,6 +397,12 @@ int main(int argc, char *argv[])
 		jsonConfig += std::string(",\"license_token_data\": \"") + licenseTokenData + std::string("\"");
 	}
 	jsonConfig += std::string(",\"gpu_ctrl_memory_enabled\": ") + (isGpuCtrlMemoryEnabled ? "true" : "false") + std::string("");
+	jsonConfig += std::string(",\"num_threads\": ") + std::to_string(numThreads);
+	jsonConfig += std::string(",\"max_latency\": ") + std::to_string(maxLatency);
+	jsonConfig += std::string(",\"max_batchsize\": ") + std::to_string(maxBatchSize);
+	jsonConfig += std::string(",\"tps_enabled\": ") + (isTpsEnabled ? "true" : "false") + std::string("");
+	jsonConfig += std::string(",\"stn_enabled\": ") + (isStnEnabled ? "true" : "false") + std::string("");
+	jsonConfig += std::string(",\"ocr_2passes\": ") + (isOcr2PassesEnabled ? "true" : "false") + std::string("");
 
 	jsonConfig += "}"; // end-of-config
 
@@ -184,6 +413,13 @@ int main(int argc, char *argv[])
 		return -1;
 	}
 
+	// Score the image like a camera frame, using its luma samples
+	std::vector<uint8_t> kycLuma;
+	kycExtractLuma(kycFile, kycLuma);
+	const size_t kycFileSizeInBytes = kycFile.width * kycFile.height
+		* (kycFile.type == KYC_VERIF_SDK_IMAGE_TYPE_Y ? 1 : (kycFile.type == KYC_VERIF_SDK_IMAGE_TYPE_RGB24 ? 3 : 4));
+	KYC_VERIF_SDK_PRINT_INFO("Frame quality score (sharpness x glare-free ratio): %lf", kycFrameQualityScore(kycLuma.data(), kycFile.width, kycFile.height));
+
 	// Function to wait until parallel callback is called
 	auto funcWaitPtr = [&](const size_t& count) -> void {
 		if (isParallelDeliveryEnabled) {
@@ -191,7 +427,7 @@ int main(int argc, char *argv[])
 			std::unique_lock<std::mutex > lk(parallelNotifMutex);
 			parallelNotifCondVar.wait_for(lk,
 				std::chrono::milliseconds(3 * 60 * 1000), // maximum number of millis to wait for before giving up, must never wait this long
-				[&count] { return (parallelNotifCount == count); }
+				[&count] { return (parallelNotifCount >= count); }
 			);
 		}
 		else {
@@ -199,6 +435,13 @@ int main(int argc, char *argv[])
 		}
 	};
 
+	// Pin the threads to the CPU set. Must be done before initializing the engine
+	// to make sure the threads it creates inherit the affinity.
+	if (!cpuSet.empty() && !setCpuAffinity(cpuSet)) {
+		printUsage("Invalid --cpu_set: " + cpuSet);
+		return -1;
+	}
+
 	// Init
 	KYC_VERIF_SDK_PRINT_INFO("Starting benchmark...");
 	KYC_VERIF_SDK_ASSERT((result = KycVerifSdkEngine::init(
@@ -206,32 +449,85 @@ int main(int argc, char *argv[])
 		jsonConfig.c_str(),
 		isParallelDeliveryEnabled ? &parallelDeliveryCallbackCallback : nullptr
 	)).isOK());
+	printMemoryUsage("init");
+
+	// Periodically write the metrics while processing
+	std::mutex metricsMutex;
+	std::condition_variable metricsCondVar;
+	bool metricsStop = false;
+	std::thread metricsThread;
+	if (!metricsFile.empty()) {
+		metricsThread = std::thread([&] {
+			std::unique_lock<std::mutex > lk(metricsMutex);
+			while (!metricsCondVar.wait_for(lk, std::chrono::milliseconds(metricsIntervalInMillis), [&] { return metricsStop; })) {
+				metrics.writePrometheus(metricsFile, isParallelDeliveryEnabled);
+			}
+		});
+	}
 
 	// WarmUp
 	// We load the models into the memory the first time the inference is called which
 	// means it'll be very slow.
 	KYC_VERIF_SDK_PRINT_INFO("Starting warmup...");
+	admission.acquire();
+	metrics.submitted();
+	const std::chrono::high_resolution_clock::time_point timeWarmupStart = std::chrono::high_resolution_clock::now();
 	KYC_VERIF_SDK_ASSERT((result = KycVerifSdkEngine::process(
 		kycFile.type,
 		kycFile.uncompressedData,
 		kycFile.width,
 		kycFile.height
 	)).isOK());
+	if (!isParallelDeliveryEnabled) {
+		metrics.observeLatency(std::chrono::duration_cast<std::chrono::duration<double >>(std::chrono::high_resolution_clock::now() - timeWarmupStart).count());
+		metrics.delivered(result);
+		admission.release();
+	}
 	funcWaitPtr(1);
 	KYC_VERIF_SDK_PRINT_INFO("Warmup done.");
+	printMemoryUsage("warmup");
 
 	// Processing
 	KYC_VERIF_SDK_PRINT_INFO("Starting processing...");
 	const std::chrono::high_resolution_clock::time_point timeStart = std::chrono::high_resolution_clock::now();
+	// With a best frame window, each loop is handled like a camera frame: it's scored and
+	// only the best frame out of the window is processed.
+	KycBestFrameSelector bestFrameSelector(bestFrameWindow);
+	size_t submittedCount = 0;
 	for (size_t i = 0; i < loopCount; ++i) {
+		const void* framePtr = kycFile.uncompressedData;
+		if (bestFrameWindow > 1) {
+			// The selector's buffer is still used by the previous window's request until its result
+			// is delivered: wait for it before the first push of the next window overwrites the buffer.
+			if (isParallelDeliveryEnabled && i > 0 && (i % bestFrameWindow) == 0) {
+				funcWaitPtr(1 + submittedCount);
+			}
+			const double score = kycFrameQualityScore(kycLuma.data(), kycFile.width, kycFile.height);
+			if (!bestFrameSelector.push(kycFile.uncompressedData, kycFileSizeInBytes, score)) {
+				continue; // Window not complete yet
+			}
+			framePtr = bestFrameSelector.best().data();
+		}
+		if (!admission.acquire()) {
+			continue; // Too many in-flight requests, reject
+		}
+		metrics.submitted();
+		const std::chrono::high_resolution_clock::time_point timeProcessStart = std::chrono::high_resolution_clock::now();
+		++submittedCount;
 		KYC_VERIF_SDK_ASSERT((result = KycVerifSdkEngine::process(
 			kycFile.type,
-			kycFile.uncompressedData,
+			framePtr,
 			kycFile.width,
 			kycFile.height
 		)).isOK());
+		if (!isParallelDeliveryEnabled) {
+			metrics.observeLatency(std::chrono::duration_cast<std::chrono::duration<double >>(std::chrono::high_resolution_clock::now() - timeProcessStart).count());
+			metrics.delivered(result);
+			admission.release();
+		}
 	}
-	funcWaitPtr(loopCount);
+	// The counter already includes the warmup result
+	funcWaitPtr(1 + submittedCount);
 
 	// Compute the estimated frame rate.
 	// At this step all frames are already processed but the result could be still on the delivery
@@ -242,14 +538,35 @@ int main(int argc, char *argv[])
 	KYC_VERIF_SDK_PRINT_INFO("Elapsed time (KYC) = [[[ %lf millis ]]]", elapsedTimeInMillis);
 
 	// Print latest result
-	const std::string& json_ = result.json();
-	if (!json_.empty()) {
-		KYC_VERIF_SDK_PRINT_INFO("result: %s", json_.c_str());
+	const char* json_ = result.json();
+	if (json_ && *json_) {
+		KYC_VERIF_SDK_PRINT_INFO("result: %s", json_);
 	}
 
 	// Print estimated frame rate
-	const double estimatedFps = 1000.f / (elapsedTimeInMillis / static_cast<double>(parallelNotifCount));
-	KYC_VERIF_SDK_PRINT_INFO("*** elapsedTimeInMillis: %lf, notified: %zu, estimatedFps: %lf ***", elapsedTimeInMillis, parallelNotifCount, estimatedFps);
+	const size_t processedCount = parallelNotifCount - 1; // minus the warmup
+	const double estimatedFps = processedCount ? (1000.f / (elapsedTimeInMillis / static_cast<double>(processedCount))) : 0.0; // nothing processed if all requests were rejected
+	KYC_VERIF_SDK_PRINT_INFO("*** elapsedTimeInMillis: %lf, notified: %zu, estimatedFps: %lf ***", elapsedTimeInMillis, processedCount, estimatedFps);
+	if (bestFrameWindow > 1) {
+		KYC_VERIF_SDK_PRINT_INFO("*** bestFrameWindow: %zu, frames: %zu, processed: %zu, bestScore: %lf ***", bestFrameWindow, loopCount, processedCount, bestFrameSelector.bestScore());
+	}
+	if (admission.maxInFlight > 0) {
+		KYC_VERIF_SDK_PRINT_INFO("*** maxInFlight: %zu, peakInFlight: %zu, rejected: %zu ***", admission.maxInFlight, admission.peakInFlight, admission.rejected);
+	}
+	printMemoryUsage("processing");
+
+	// Export final metrics
+	if (metricsThread.joinable()) {
+		{
+			std::lock_guard<std::mutex > lk(metricsMutex);
+			metricsStop = true;
+		}
+		metricsCondVar.notify_one();
+		metricsThread.join();
+		if (metrics.writePrometheus(metricsFile, isParallelDeliveryEnabled)) {
+			KYC_VERIF_SDK_PRINT_INFO("Metrics written to: %s", metricsFile.c_str());
+		}
+	}
 
 	KYC_VERIF_SDK_PRINT_INFO("Press any key to terminate !!");
 	getchar();
@@ -276,6 +593,18 @@ static void printUsage(const std::string& message /*= ""*/)
 		"\t[--vino_activation <openvino-activation-mode>] \n"
 		"\t[--parallel <whether-to-enable-inter-parallel-mode:true/false>] \n"
 		"\t[--gpu_ctrl_mem <whether-to-enable-gpu-memory-ctrl:true/false>] \n"
+		"\t[--num_threads <number-of-threads>] \n"
+		"\t[--max_latency <maximum-latency-in-millis>] \n"
+		"\t[--max_batchsize <maximum-batch-size>] \n"
+		"\t[--best_frame_window <number-of-frames-per-window>] \n"
+		"\t[--cpu_set <list-of-cpus-to-run-on>] \n"
+		"\t[--max_inflight <maximum-number-of-inflight-requests>] \n"
+		"\t[--inflight_policy <policy-when-inflight-limit-reached:block/reject>] \n"
+		"\t[--tps <whether-to-enable-tps:true/false>] \n"
+		"\t[--stn <whether-to-enable-stn:true/false>] \n"
+		"\t[--ocr_2passes <whether-to-enable-ocr-2nd-pass:true/false>] \n"
+		"\t[--metrics_file <path-to-output-metrics-file>] \n"
+		"\t[--metrics_interval <metrics-write-interval-in-millis>] \n"
 		"\t[--tokenfile <path-to-license-token-file>] \n"
 		"\t[--tokendata <base64-license-token-data>] \n"
 		"\n"
@@ -287,8 +616,139 @@ static void printUsage(const std::string& message /*= ""*/)
 		"--vino_activation: OpenVINO activation type. Default: \"auto\". \n\n"
 		"--parallel: Whether to enabled the parallel mode. Default: true.\n\n"
 		"--gpu_ctrl_mem: Whether to enabled the GPU memory control. Default: true.\n\n"
+		"--num_threads: Maximum number of threads to use. -1 means auto. Default: -1.\n\n"
+		"--max_latency: Maximum time (in millis) to wait for a batch to be filled in parallel mode. -1 means auto. Default: -1.\n\n"
+		"--max_batchsize: Maximum number of documents processed in a single batch in parallel mode. -1 means auto. Default: -1.\n\n"
+		"--best_frame_window: Handle each loop as a camera frame and only process the best frame (sharpness, glare) out of each window of this many frames. 1 means all frames are processed. Must not be greater than --loops. Default: 1.\n\n"
+		"--cpu_set: List of CPUs to pin the engine threads to (e.g. \"0-15,32-47\" for the first socket). Default: null (all CPUs).\n\n"
+		"--max_inflight: Maximum number of requests submitted but not delivered yet (parallel mode). 0 means unbounded. Default: 0.\n\n"
+		"--inflight_policy: What to do when the maximum number of in-flight requests is reached: \"block\" until a result is delivered or \"reject\" the request. Default: \"block\".\n\n"
+		"--tps: Whether to enable the Thin Plate Spline (TPS) stage. Default: true.\n\n"
+		"--stn: Whether to enable the Spatial Transformer Network (STN) stage. Default: true.\n\n"
+		"--ocr_2passes: Whether to enable the OCR 2nd pass. Default: true.\n\n"
+		"--metrics_file: Path to the file where to write the runtime metrics (Prometheus text format). The file is rewritten every --metrics_interval millis while processing and at the end. Default: null.\n\n"
+		"--metrics_interval: Interval (in millis) between two writes of the metrics file. Default: 1000.\n\n"
 		"--tokenfile: Path to the file containing the base64 license token if you have one. If not provided then, the application will act like a trial version. Default: null.\n\n"
 		"--tokendata: Base64 license token if you have one. If not provided then, the application will act like a trial version. Default: null.\n\n"
 		"********************************************************************************\n"
 	);
-}
\ No newline at end of file
+}
+
+static bool memoryUsage(size_t& currentInBytes, size_t& peakInBytes)
+{
+	currentInBytes = peakInBytes = 0;
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return false;
+	}
+	currentInBytes = static_cast<size_t>(counters.WorkingSetSize);
+	peakInBytes = static_cast<size_t>(counters.PeakWorkingSetSize);
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return false;
+	}
+	peakInBytes = static_cast<size_t>(usage.ru_maxrss) * 1024; // ru_maxrss is in kilobytes on Linux
+	FILE* file = fopen("/proc/self/statm", "r");
+	if (!file) {
+		return false;
+	}
+	unsigned long sizeInPages = 0, residentInPages = 0;
+	const bool parsed = (fscanf(file, "%lu %lu", &sizeInPages, &residentInPages) == 2);
+	fclose(file);
+	if (!parsed) {
+		return false;
+	}
+	currentInBytes = static_cast<size_t>(residentInPages) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+	return true;
+}
+
+static void printMemoryUsage(const char* step)
+{
+	size_t currentInBytes, peakInBytes;
+	if (memoryUsage(currentInBytes, peakInBytes)) {
+		KYC_VERIF_SDK_PRINT_INFO("*** Memory usage after %s: current RSS = %zu MB, peak RSS = %zu MB ***",
+			step,
+			currentInBytes >> 20,
+			peakInBytes >> 20
+		);
+	}
+	else {
+		KYC_VERIF_SDK_PRINT_WARN("Failed to retrieve memory usage after %s", step);
+	}
+}
+
+static bool setCpuAffinity(const std::string& cpuSet)
+{
+#if defined(_WIN32)
+	DWORD_PTR mask = 0;
+	const long maxCpus = static_cast<long>(sizeof(DWORD_PTR) * 8);
+#else
+	cpu_set_t mask;
+	CPU_ZERO(&mask);
+	const long maxCpus = static_cast<long>(CPU_SETSIZE);
+#endif
+
+	// Parse the list (e.g. "0-3,8,10-11") and set the bits while parsing
+	// Each entry is "<cpu>" or "<first>-<last>", with no empty entry.
+	auto funcParseCpu = [&](const char* str, const char** end, long& cpu) -> bool {
+		if (*str < '0' || *str > '9') { // rejects empty bounds and signs
+			return false;
+		}
+		char* end_ = nullptr;
+		cpu = std::strtol(str, &end_, 10);
+		*end = end_;
+		if (cpu >= maxCpus) {
+			KYC_VERIF_SDK_PRINT_ERROR("CPU #%ld is outside the affinity mask (max %ld CPUs)", cpu, maxCpus);
+			return false;
+		}
+		return true;
+	};
+	const char* ptr = cpuSet.c_str();
+	if (!*ptr) {
+		return false;
+	}
+	while (true) {
+		long first, last;
+		if (!funcParseCpu(ptr, &ptr, first)) {
+			return false;
+		}
+		last = first;
+		if (*ptr == '-' && !funcParseCpu(ptr + 1, &ptr, last)) {
+			return false;
+		}
+		if (last < first) {
+			return false;
+		}
+		for (long cpu = first; cpu <= last; ++cpu) {
+#if defined(_WIN32)
+			mask |= (static_cast<DWORD_PTR>(1) << cpu);
+#else
+			CPU_SET(static_cast<int>(cpu), &mask);
+#endif
+		}
+		if (*ptr == '\0') {
+			break;
+		}
+		if (*ptr != ',') { // e.g. "1-2-3" or "1x"
+			return false;
+		}
+		++ptr; // "," must be followed by another entry
+	}
+
+#if defined(_WIN32)
+	if (!SetProcessAffinityMask(GetCurrentProcess(), mask)) {
+		KYC_VERIF_SDK_PRINT_ERROR("SetProcessAffinityMask failed with error code %lu", GetLastError());
+		return false;
+	}
+#else
+	if (sched_setaffinity(0, sizeof(mask), &mask) != 0) {
+		KYC_VERIF_SDK_PRINT_ERROR("sched_setaffinity failed");
+		return false;
+	}
+#endif
+	KYC_VERIF_SDK_PRINT_INFO("Threads pinned to CPU set: %s", cpuSet.c_str());
+	return true;
+}
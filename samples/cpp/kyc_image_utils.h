@@ -5,6 +5,9 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <map>
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
 #include <sys/stat.h>
 #include <codecvt>
 
@@ -114,4 +117,130 @@ static bool kycParseArgs(int argc, char *argv[], std::map<std::string, std::stri
 }
 
 
+/*
+* Extracts the luma (Y) samples from a decoded file (RGB24, RGBA32 or Y) using BT.601 weights.
+* @param file The decoded file.
+* @param luma The luma samples, width * height bytes.
+*/
+static inline void kycExtractLuma(const FldFile& file, std::vector<uint8_t>& luma)
+{
+	KYC_VERIF_SDK_ASSERT(file.isValid());
+	const size_t count = file.width * file.height;
+	const uint8_t* ptr = static_cast<const uint8_t*>(file.uncompressedData);
+	luma.resize(count);
+	if (file.type == KYC_VERIF_SDK_IMAGE_TYPE_Y) {
+		std::copy(ptr, ptr + count, luma.begin());
+		return;
+	}
+	KYC_VERIF_SDK_ASSERT(file.type == KYC_VERIF_SDK_IMAGE_TYPE_RGB24 || file.type == KYC_VERIF_SDK_IMAGE_TYPE_RGBA32);
+	const size_t channels = (file.type == KYC_VERIF_SDK_IMAGE_TYPE_RGB24) ? 3 : 4;
+	for (size_t i = 0; i < count; ++i, ptr += channels) {
+		luma[i] = static_cast<uint8_t>((77 * ptr[0] + 150 * ptr[1] + 29 * ptr[2]) >> 8);
+	}
+}
+
+/*
+* Computes a quality score for a camera frame using its luma (Y) samples only, which means
+* it works with any YUV-family type (NV12, NV21, YUV420P...) without conversion.
+* The score is the sharpness (variance of the Laplacian) weighted by the fraction of pixels
+* without glare (saturated samples). Higher is better. Use it to pick the frame to process
+* instead of processing every frame.
+* @param yPtr Pointer to the start of the Y (luma) samples.
+* @param width Width in samples.
+* @param height Height in samples.
+* @param strideInBytes Stride in bytes for the Y samples. Zero means same as width.
+* @param step Sampling step, 1 means all pixels. Use 2 or more to speedup the computation on large frames.
+* @returns the score, or 0 if the frame is too small.
+*/
+static inline double kycFrameQualityScore(const void* yPtr, const size_t width, const size_t height, size_t strideInBytes = 0, const size_t step = 2)
+{
+	KYC_VERIF_SDK_ASSERT(yPtr != nullptr && step > 0);
+	if (!strideInBytes) {
+		strideInBytes = width;
+	}
+	if (width < 3 || height < 3) {
+		return 0.0;
+	}
+
+	const uint8_t* yPtr_ = static_cast<const uint8_t*>(yPtr);
+	double sum = 0.0, sumSquare = 0.0;
+	size_t count = 0, glareCount = 0;
+	for (size_t j = 1; j < height - 1; j += step) {
+		const uint8_t* row = yPtr_ + (j * strideInBytes);
+		for (size_t i = 1; i < width - 1; i += step) {
+			const int laplacian = static_cast<int>(row[i - 1]) + static_cast<int>(row[i + 1])
+				+ static_cast<int>(row[i - strideInBytes]) + static_cast<int>(row[i + strideInBytes])
+				- (static_cast<int>(row[i]) << 2);
+			sum += laplacian;
+			sumSquare += static_cast<double>(laplacian * laplacian);
+			glareCount += (row[i] >= 250);
+			++count;
+		}
+	}
+	const double mean = sum / static_cast<double>(count);
+	const double sharpness = (sumSquare / static_cast<double>(count)) - (mean * mean);
+	const double glareRatio = static_cast<double>(glareCount) / static_cast<double>(count);
+	return sharpness * (1.0 - glareRatio);
+}
+
+/*
+* Keeps the best frame out of a window of consecutive camera frames so that the processing
+* function is called once per window instead of once per frame.
+* Only frames better than the current best are copied.
+* best() points into the selector's buffer which is overwritten by the first push of the next window:
+* in parallel mode (result delivered through the callback) the buffer must stay untouched until the
+* result is delivered, wait for the callback before pushing the next window's first frame.
+* \code{.cpp}
+* KycBestFrameSelector selector(10); // process 1 frame out of 10
+* const size_t frameSize = (width * height * 3) >> 1; // NV12
+* while (...) { // camera loop
+*	const double score = kycFrameQualityScore(frame->yPtr, width, height);
+*	if (selector.push(frame->yPtr, frameSize, score)) {
+*		// Sequential mode: process() returns once done with the frame, best() is free again after the call.
+*		const uint8_t* best = selector.best().data();
+*		KYC_VERIF_SDK_ASSERT((result = KycVerifSdkEngine::process(
+*			KYC_VERIF_SDK_IMAGE_TYPE_NV12,
+*			best, best + (width * height), best + (width * height) + 1, // Y, U, V (interleaved)
+*			width, height,
+*			width, width, width, 2
+*		)).isOK());
+*	}
+* }
+* \endcode
+*/
+class KycBestFrameSelector {
+public:
+	KycBestFrameSelector(const size_t windowSize) : m_nWindowSize(windowSize ? windowSize : 1) { }
+
+	/*
+	* Adds a frame to the current window.
+	* @param framePtr Pointer to the frame data (all planes, contiguous).
+	* @param frameSize Size of the frame data in bytes.
+	* @param score Score returned by kycFrameQualityScore.
+	* @returns true if the window is complete, in which case best() holds the frame to process.
+	* The first push of a window overwrites the previous window's best frame.
+	*/
+	bool push(const void* framePtr, const size_t frameSize, const double score) {
+		KYC_VERIF_SDK_ASSERT(framePtr != nullptr && frameSize > 0);
+		if (m_nCount >= m_nWindowSize) { // previous window was complete
+			m_nCount = 0;
+		}
+		if (m_nCount == 0 || score > m_dBestScore) {
+			const uint8_t* framePtr_ = static_cast<const uint8_t*>(framePtr);
+			m_vecBest.assign(framePtr_, framePtr_ + frameSize);
+			m_dBestScore = score;
+		}
+		return (++m_nCount >= m_nWindowSize);
+	}
+
+	inline const std::vector<uint8_t>& best() const { return m_vecBest; }
+	inline double bestScore() const { return m_dBestScore; }
+
+private:
+	size_t m_nWindowSize;
+	size_t m_nCount = 0;
+	double m_dBestScore = 0.0;
+	std::vector<uint8_t> m_vecBest;
+};
+
 #endif /* _KYC_VERIF_SDK_SAMPLES_UTILS_H_ */
@@ -45,13 +45,13 @@ public:
 	virtual void onNewResult(const KycVerifSdkResult* result) const override {
 		// Use m_pMyDummyData here if you want
 		KYC_VERIF_SDK_ASSERT(result != nullptr);
-		const std::string& json = result->json();
+		const char* json = result->json(); // no copy, only valid during the callback
 		// Printing to the console could be very slow and delayed -> stop displaying the result as soon as all faces are processed
 		KYC_VERIF_SDK_PRINT_INFO("MyKycVerifSdkParallelDeliveryCallback::onNewResult(%d, %s, %zu): %s",
 			result->code(),
 			result->phrase(),
 			++parallelNotifCount,
-			!json.empty() ? json.c_str() : "{}"
+			(json && *json) ? json : "{}"
 		);
 		parallelNotifCondVar.notify_one();
 	}
@@ -216,9 +216,9 @@ int main(int argc, char *argv[])
 	}
 
 	// Print latest result
-	const std::string& json_ = result.json();
-	if (!json_.empty()) {
-		KYC_VERIF_SDK_PRINT_INFO("result: %s", json_.c_str());
+	const char* json_ = result.json();
+	if (json_ && *json_) {
+		KYC_VERIF_SDK_PRINT_INFO("result: %s", json_);
 	}
 
 	KYC_VERIF_SDK_PRINT_INFO("Press any key to terminate !!");